@@ -0,0 +1,23 @@
+/* Forced-BMX280 Library
+   soylentOrange - https://github.com/soylentOrange/Forced-BMX280
+
+   Virtual clock for replaying bus traces.
+   Time only advances with delay() and the (simulated) bus transfers,
+   so replays are deterministic.
+*/
+
+#include "Arduino.h"
+
+static unsigned long s_micros = 0;
+
+void delay(unsigned long ms) {
+  s_micros += ms * 1000;
+}
+
+unsigned long micros() {
+  return s_micros;
+}
+
+void advanceMicros(unsigned long us) {
+  s_micros += us;
+}
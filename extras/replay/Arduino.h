@@ -0,0 +1,24 @@
+/* Forced-BMX280 Library
+   soylentOrange - https://github.com/soylentOrange/Forced-BMX280
+
+   Minimal host-side stand-in for the Arduino core,
+   just enough to build the library for replaying bus traces.
+*/
+
+#ifndef __FORCED_BMX280_REPLAY_ARDUINO_H
+#define __FORCED_BMX280_REPLAY_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define _BV(bit) (1 << (bit))
+
+typedef uint8_t byte;
+
+void delay(unsigned long ms);
+unsigned long micros();
+
+// advance the virtual clock (host only)
+void advanceMicros(unsigned long us);
+
+#endif  //__FORCED_BMX280_REPLAY_ARDUINO_H
@@ -0,0 +1,208 @@
+/* Forced-BMX280 Library
+   soylentOrange - https://github.com/soylentOrange/Forced-BMX280
+
+   Fake two-wire bus replaying a trace recorded with setTraceBuffer().
+*/
+
+#include "Wire.h"
+#include "forcedBMX280.h"
+
+TwoWire Wire;
+
+/// \brief
+/// Constructor
+/// \details
+/// This creates a bus without a trace, every transaction diverges.
+TwoWire::TwoWire()
+  : _trace(nullptr),
+    _length(0),
+    _position(0),
+    _record(0),
+    _payload(0),
+    _diverged(false),
+    _exhausted(false) {
+  /*..*/
+}
+
+/// \brief
+/// setTrace
+/// \details
+/// Sets the trace (as recorded with setTraceBuffer()) to be replayed.
+void TwoWire::setTrace(const uint8_t* trace, const size_t length) {
+  _trace = trace;
+  _length = length;
+  _position = 0;
+  _record = 0;
+  _payload = 0;
+  _diverged = false;
+  _exhausted = false;
+}
+
+/// \brief
+/// isDiverged
+/// \details
+/// True if the library didn't follow the recorded transactions.
+bool TwoWire::isDiverged() {
+  return _diverged;
+}
+
+/// \brief
+/// isFinished
+/// \details
+/// True if all recorded transactions have been replayed.
+bool TwoWire::isFinished() {
+  return _diverged || _position >= _length;
+}
+
+/// \brief
+/// isExhausted
+/// \details
+/// True if the library started a transaction after the end of the trace,
+/// i.e. the recording ended in the middle of a sample.
+bool TwoWire::isExhausted() {
+  return _exhausted;
+}
+
+/// \brief
+/// Start record
+/// \details
+/// Starts the next record, running out of trace is not a divergence.
+/// Malformed records (bus status without payload, bus status on a read,
+/// payload beyond the end of the trace) make the replay diverge.
+/// Returns false if there is no record to replay.
+bool TwoWire::startRecord() {
+  if (_diverged || _exhausted) return false;
+  if (_position >= _length) {
+    _exhausted = true;
+    return false;
+  }
+
+  _record = _position;
+  _payload = 0;
+
+  uint8_t header = _trace[_record];
+  uint8_t length = header & TRACE_LENGTH;
+  if ((header & TRACE_ERROR) && ((length == 0) || (header & TRACE_READ))) {
+    diverge();
+    return false;
+  }
+  if (_record + 1 + length > _length) {
+    diverge();
+    return false;
+  }
+
+  _position = _record + 1 + length;
+  return true;
+}
+
+/// \brief
+/// getPosition
+/// \details
+/// Offset of the current record in the trace.
+size_t TwoWire::getPosition() {
+  return _record;
+}
+
+/// \brief
+/// Record length
+/// \details
+/// Number of payload bytes in the current record, without bus status.
+/// The record has been checked by startRecord().
+uint8_t TwoWire::recordLength() {
+  uint8_t length = _trace[_record] & TRACE_LENGTH;
+  if (_trace[_record] & TRACE_ERROR) length--;
+  return length;
+}
+
+/// \brief
+/// Diverge
+/// \details
+/// Marks the replay as diverged, all following transactions fail.
+void TwoWire::diverge() {
+  _diverged = true;
+}
+
+void TwoWire::begin() {
+  /*..*/
+}
+
+/// \brief
+/// Begin transmission
+/// \details
+/// Expects a write record as the next record in the trace.
+void TwoWire::beginTransmission(uint8_t address) {
+  (void)address;
+  if (!startRecord()) return;
+  if (_trace[_record] & TRACE_READ) {
+    diverge();
+    return;
+  }
+
+  advanceMicros(REPLAY_BYTE_TIME);
+}
+
+/// \brief
+/// Write
+/// \details
+/// Compares the written byte (value) with the recorded one.
+size_t TwoWire::write(uint8_t value) {
+  if (_diverged || _exhausted) return 0;
+  if (_payload >= recordLength() || _trace[_record + 1 + _payload] != value) {
+    diverge();
+    return 0;
+  }
+
+  _payload++;
+  advanceMicros(REPLAY_BYTE_TIME);
+  return 1;
+}
+
+/// \brief
+/// End transmission
+/// \details
+/// Returns the recorded bus status.
+uint8_t TwoWire::endTransmission() {
+  if (_diverged || _exhausted) return 4;
+  if (_payload != recordLength()) {
+    diverge();
+    return 4;
+  }
+
+  if (_trace[_record] & TRACE_ERROR) return _trace[_record + 1 + _payload];
+  return 0;
+}
+
+/// \brief
+/// Request from
+/// \details
+/// Expects a read record as the next record in the trace.
+/// Returns the number of recorded bytes.
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t count) {
+  (void)address;
+  (void)count;
+  if (!startRecord()) return 0;
+  if (!(_trace[_record] & TRACE_READ)) {
+    diverge();
+    return 0;
+  }
+
+  advanceMicros(REPLAY_BYTE_TIME);
+  return recordLength();
+}
+
+/// \brief
+/// Read
+/// \details
+/// Returns the next recorded byte or -1 if there is none.
+/// Past the end of the trace 0 is returned, so waiting for the
+/// sensor (e.g. for the NVM copy in begin()) doesn't loop forever.
+int TwoWire::read() {
+  if (_exhausted) return 0;
+  if (_diverged || _payload >= recordLength()) {
+    diverge();
+    return -1;
+  }
+
+  advanceMicros(REPLAY_BYTE_TIME);
+  return _trace[_record + 1 + _payload++];
+}
@@ -0,0 +1,49 @@
+/* Forced-BMX280 Library
+   soylentOrange - https://github.com/soylentOrange/Forced-BMX280
+
+   Fake two-wire bus replaying a trace recorded with setTraceBuffer().
+   Writes are checked against the recorded ones, reads return the recorded
+   bytes. Any mismatch marks the replay as diverged.
+*/
+
+#ifndef __FORCED_BMX280_REPLAY_WIRE_H
+#define __FORCED_BMX280_REPLAY_WIRE_H
+
+#include "Arduino.h"
+
+#define REPLAY_BYTE_TIME (90)  // time for one byte incl. ack at 100kHz in us
+
+class TwoWire {
+private:
+  const uint8_t* _trace;
+  size_t _length;
+  size_t _position;  // header of the next record
+  size_t _record;    // header of the current record
+  uint8_t _payload;  // payload bytes of the current record consumed so far
+  bool _diverged;
+  bool _exhausted;
+
+  uint8_t recordLength();
+  void diverge();
+  bool startRecord();
+
+public:
+  TwoWire();
+
+  void setTrace(const uint8_t* trace, const size_t length);
+  bool isDiverged();
+  bool isFinished();
+  bool isExhausted();
+  size_t getPosition();
+
+  void begin();
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t value);
+  uint8_t endTransmission();
+  uint8_t requestFrom(uint8_t address, uint8_t count);
+  int read();
+};
+
+extern TwoWire Wire;
+
+#endif  //__FORCED_BMX280_REPLAY_WIRE_H
@@ -0,0 +1,67 @@
+/* Forced-BMX280 Library
+   soylentOrange - https://github.com/soylentOrange/Forced-BMX280
+
+   Replays a bus trace recorded with setTraceBuffer() on the host.
+   The sequence of calls in replaySample() needs to match the one
+   used in the firmware the trace was recorded with.
+*/
+
+#include <stdio.h>
+#include <vector>
+#include "forcedBMX280.h"
+
+// sensor fed by the replayed trace
+ForcedBME280 climateSensor = ForcedBME280();
+
+/// \brief
+/// Replay sample
+/// \details
+/// Replays the calls for a single sample.
+/// Adapt to the sequence used in your firmware.
+static void replaySample() {
+  climateSensor.takeForcedMeasurement();
+  int32_t temperature = climateSensor.getTemperatureCelsius();
+  uint32_t pressure = climateSensor.getPressure();
+  uint32_t humidity = climateSensor.getRelativeHumidity();
+  if (Wire.isDiverged() || Wire.isExhausted()) return;
+
+  uint32_t absTemperature = temperature < 0 ? -(uint32_t)temperature : (uint32_t)temperature;
+
+  printf("%s%lu.%02lu °C\t%lu.%02lu hPa\t%lu.%02lu %%rh\t%lu us\n",
+         temperature < 0 ? "-" : "",
+         (unsigned long)(absTemperature / 100), (unsigned long)(absTemperature % 100),
+         (unsigned long)(pressure / 100), (unsigned long)(pressure % 100),
+         (unsigned long)(humidity / 100), (unsigned long)(humidity % 100),
+         (unsigned long)climateSensor.getBusTime());
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <trace>\n", argv[0]);
+    return 2;
+  }
+
+  // load trace
+  FILE* file = fopen(argv[1], "rb");
+  if (!file) {
+    perror(argv[1]);
+    return 2;
+  }
+  std::vector<uint8_t> trace;
+  int c;
+  while ((c = fgetc(file)) != EOF) trace.push_back((uint8_t)c);
+  fclose(file);
+  Wire.setTrace(trace.data(), trace.size());
+
+  // replay
+  uint8_t error = climateSensor.begin();
+  printf("begin: %u, chip ID: 0x%02X\n", error, climateSensor.getChipID());
+  while (!error && !Wire.isFinished()) replaySample();
+
+  if (Wire.isDiverged()) {
+    fprintf(stderr, "replay diverged from trace at offset %lu\n", (unsigned long)Wire.getPosition());
+    return 1;
+  }
+
+  return 0;
+}
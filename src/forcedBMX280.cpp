@@ -30,8 +30,20 @@ ForcedBMX280::ForcedBMX280(TwoWire& bus, const uint8_t address)
   :
 #endif
     _bus(bus),
-    _address(address)  {
-  /*..*/
+    _address(address),
+    _chipID(0),
+    _availableChannels(CHANNEL_TEMPERATURE)  {
+#ifdef FORCED_BMX280_BUS_TIME
+  _busTime = 0;
+#endif
+#ifdef FORCED_BMX280_TRACE
+  _trace = nullptr;
+  _traceSize = 0;
+  _traceLength = 0;
+  _traceRecord = 0;
+  _traceTransaction = 0;
+#endif
+  setChannels(_availableChannels);
 }
 
 /// \brief
@@ -39,20 +51,49 @@ ForcedBMX280::ForcedBMX280(TwoWire& bus, const uint8_t address)
 /// \details
 /// This function reads 16 bits from the I2C bus.
 int16_t ForcedBMX280::readTwoRegisters() {
-  uint8_t lo = _bus.read();
-  uint8_t hi = _bus.read();
+  uint8_t lo = readByte();
+  uint8_t hi = readByte();
   return hi << 8 | lo;
 }
 
 /// \brief
-/// Read 32 bits
+/// Parse raw value
+/// \details
+/// This function assembles a 20 bit raw value (msb, lsb, xlsb) as read
+/// from the temperature or pressure data registers.
+int32_t ForcedBMX280::parseRawValue(const uint8_t* data) {
+  return (uint32_t)data[0] << 12 | (uint32_t)data[1] << 4 | (data[2] >> 4 & 0x0F);
+}
+
+/// \brief
+/// Read burst
 /// \details
-/// This function reads 32 bits from the I2C bus.
-int32_t ForcedBMX280::readFourRegisters() {
-  uint8_t msb = _bus.read();
-  uint8_t lsb = _bus.read();
-  uint8_t xlsb = _bus.read();
-  return (uint32_t)msb << 12 | (uint32_t)lsb << 4 | (xlsb >> 4 & 0x0F);
+/// This function reads a number of consecutive registers (length) starting
+/// at register (reg) into (data). If performMeasurement is true, a forced
+/// measurement is started within the same transaction. The registers are
+/// requested even if selecting them failed, like the getters always did.
+/// Returns an error code if there was one from the bus
+uint8_t ForcedBMX280::readBurst(uint8_t reg, uint8_t* data, uint8_t length, const bool performMeasurement) {
+#ifdef FORCED_BMX280_BUS_TIME
+  uint32_t start = micros();
+  if (performMeasurement) _busTime = 0;
+#endif
+
+  beginTransmission();
+  if (performMeasurement) {
+    writeByte((uint8_t)registers::CTRL_MEAS);
+    writeByte(_ctrlMeas);
+  }
+  writeByte(reg);
+  uint8_t error = endTransmission() ? ERROR_BUS : ERROR_OK;
+
+  requestFrom(length);
+  for (uint8_t i = 0; i < length; i++) data[i] = readByte();
+#ifdef FORCED_BMX280_BUS_TIME
+  _busTime += micros() - start;
+#endif
+
+  return error;
 }
 
 /// \brief
@@ -60,11 +101,11 @@ int32_t ForcedBMX280::readFourRegisters() {
 /// \details
 /// This function reads 8 bits from the register (reg) via I2C bus.
 uint8_t ForcedBMX280::read8(uint8_t reg) {
-  _bus.beginTransmission(_address);
-  _bus.write(reg);
-  _bus.endTransmission();
-  _bus.requestFrom(_address, (byte)1);
-  return _bus.read();
+  beginTransmission();
+  writeByte(reg);
+  endTransmission();
+  requestFrom((byte)1);
+  return readByte();
 }
 
 /// \brief
@@ -73,10 +114,10 @@ uint8_t ForcedBMX280::read8(uint8_t reg) {
 /// This function writes 8 bits (value) to the device into to register (reg).
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBMX280::write8(uint8_t reg, uint8_t value) {
-  _bus.beginTransmission(_address);
-  _bus.write(reg);
-  _bus.write(value);
-  if (_bus.endTransmission()) return ERROR_BUS;
+  beginTransmission();
+  writeByte(reg);
+  writeByte(value);
+  if (endTransmission()) return ERROR_BUS;
 
   return ERROR_OK;
 }
@@ -87,13 +128,161 @@ uint8_t ForcedBMX280::write8(uint8_t reg, uint8_t value) {
 /// This function selects a register (reg) of the sensor.
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBMX280::setReg(uint8_t reg) {
-  _bus.beginTransmission(_address);
-  _bus.write(reg);
-  if (_bus.endTransmission()) return ERROR_BUS;
+  beginTransmission();
+  writeByte(reg);
+  if (endTransmission()) return ERROR_BUS;
 
   return ERROR_OK;
 }
 
+/* Bus access
+   All transfers with the sensor go through these helpers. They are
+   inline and reduce to the plain bus calls unless FORCED_BMX280_TRACE
+   is defined, so they are only available within this file.
+*/
+/// \brief
+/// Begin transmission
+/// \details
+/// This function starts a write transaction to the sensor
+/// and - if tracing - a write record in the bus trace.
+inline void ForcedBMX280::beginTransmission() {
+  _bus.beginTransmission(_address);
+#ifdef FORCED_BMX280_TRACE
+  _traceTransaction = _traceLength;
+  beginTraceRecord(0);
+#endif
+}
+
+/// \brief
+/// Write byte
+/// \details
+/// This function queues a byte (value) for the running write transaction.
+inline void ForcedBMX280::writeByte(uint8_t value) {
+  _bus.write(value);
+#ifdef FORCED_BMX280_TRACE
+  appendTraceRecord(value);
+#endif
+}
+
+/// \brief
+/// End transmission
+/// \details
+/// This function finishes a write transaction to the sensor.
+/// Returns the status of the bus, a non-zero status is traced as well.
+inline uint8_t ForcedBMX280::endTransmission() {
+#ifdef FORCED_BMX280_TRACE
+  uint8_t status = _bus.endTransmission();
+  if (status && _trace) {
+    _trace[_traceRecord] |= TRACE_ERROR;
+    appendTraceRecord(status);
+  }
+
+  return status;
+#else
+  return _bus.endTransmission();
+#endif
+}
+
+/// \brief
+/// Request from
+/// \details
+/// This function requests a number of bytes (count) from the sensor
+/// and - if tracing - starts a read record in the bus trace.
+/// Returns the number of bytes received.
+inline uint8_t ForcedBMX280::requestFrom(uint8_t count) {
+#ifdef FORCED_BMX280_TRACE
+  uint8_t received = _bus.requestFrom(_address, count);
+  beginTraceRecord(TRACE_READ);
+
+  return received;
+#else
+  return _bus.requestFrom(_address, count);
+#endif
+}
+
+/// \brief
+/// Read byte
+/// \details
+/// This function reads a requested byte from the bus.
+inline uint8_t ForcedBMX280::readByte() {
+#ifdef FORCED_BMX280_TRACE
+  uint8_t value = _bus.read();
+  appendTraceRecord(value);
+
+  return value;
+#else
+  return _bus.read();
+#endif
+}
+
+#ifdef FORCED_BMX280_TRACE
+
+/// \brief
+/// Begin trace record
+/// \details
+/// This function starts a new record (header) in the bus trace.
+/// If the record doesn't fit, the whole transaction (i.e. the register
+/// select and the data read) is dropped and tracing stops.
+void ForcedBMX280::beginTraceRecord(uint8_t header) {
+  if (!_trace) return;
+  if (_traceLength >= _traceSize) {
+    _traceLength = _traceTransaction;
+    _trace = nullptr;
+    return;
+  }
+
+  _traceRecord = _traceLength;
+  _trace[_traceLength++] = header;
+}
+
+/// \brief
+/// Append trace record
+/// \details
+/// This function appends a byte (value) to the current record in the
+/// bus trace. If the record doesn't fit, the whole transaction is dropped
+/// and tracing stops.
+void ForcedBMX280::appendTraceRecord(uint8_t value) {
+  if (!_trace) return;
+  if ((_traceLength >= _traceSize) || ((_trace[_traceRecord] & TRACE_LENGTH) == TRACE_LENGTH)) {
+    _traceLength = _traceTransaction;
+    _trace = nullptr;
+    return;
+  }
+
+  _trace[_traceRecord]++;
+  _trace[_traceLength++] = value;
+}
+
+/// \brief
+/// setTraceBuffer
+/// \details
+/// Starts recording the bus transactions with the sensor into a buffer
+/// of the given size. Each record consists of a header byte and its payload:
+/// TRACE_READ is set for bytes read from the sensor (otherwise the bytes
+/// were written to it), TRACE_LENGTH masks the number of payload bytes.
+/// If TRACE_ERROR is set, the last payload byte is the non-zero bus status.
+/// Recording stops when the buffer is full, the trace then ends with the
+/// last complete transaction. Pass nullptr to stop recording
+/// while keeping the length of the recorded trace.
+void ForcedBMX280::setTraceBuffer(uint8_t* buffer, const uint16_t size) {
+  _trace = buffer;
+  if (!buffer) return;
+
+  _traceSize = size;
+  _traceLength = 0;
+  _traceRecord = 0;
+  _traceTransaction = 0;
+}
+
+/// \brief
+/// getTraceLength
+/// \details
+/// Number of bytes recorded into the trace buffer
+uint16_t ForcedBMX280::getTraceLength() {
+  return _traceLength;
+}
+#endif
+
 
 /// \brief
 /// begin
@@ -105,8 +294,8 @@ uint8_t ForcedBMX280::begin() {
   _bus.begin();
 
   // Check that something is attached to the bus at the given address
-  _bus.beginTransmission(_address);
-  if (_bus.endTransmission()) return ERROR_BUS;
+  beginTransmission();
+  if (endTransmission()) return ERROR_BUS;
 
   // Read chip ID
   _chipID = read8((uint8_t)registers::CHIPID);
@@ -145,38 +334,192 @@ uint8_t ForcedBMX280::getChipID() {
 }
 
 /// \brief
-/// Take forced measurement
+/// setChannels
 /// \details
-/// This function takes a forced measurement. That is, the BME280 is woken up to take
-/// a measurement after which it goes back to sleep. During this sleep, it consumes
-/// 0.25uA!
+/// Selects the channels (CHANNEL_TEMPERATURE, CHANNEL_PRESSURE, CHANNEL_HUMIDITY)
+/// to be converted by the sensor. Disabled channels are skipped (oversampling 0)
+/// and don't add to the measurement time. Temperature is always converted as
+/// it is needed for compensation of the other channels. Channels not supported
+/// by the class or the connected chip are ignored.
 /// Returns an error code if there was one from the bus
-uint8_t ForcedBMX280::takeForcedMeasurement() {
+uint8_t ForcedBMX280::setChannels(const uint8_t channels) {
+  _channels = (channels & _availableChannels) | CHANNEL_TEMPERATURE;
 
   // ctrl_meas - see datasheet section 5.4.5
   // forced mode: ctrl_meas[0..1] 0b01 (0b11 for normal and 0b00 for sleep mode)
-  // pressure oversampling x 1: ctrl_meas[4..2] 0b001
+  // pressure oversampling x 1 or skipped: ctrl_meas[4..2] 0b001 or 0b000
   // temperature oversampling x 1: ctrl_meas[7..5] 0b001
-  if (write8((uint8_t)registers::CTRL_MEAS, 0b00100101)) return ERROR_BUS;
+  _ctrlMeas = 0b00100001;
+  if (_channels & CHANNEL_PRESSURE) _ctrlMeas |= 0b00000100;
+
+  // ctrl_hum - see datasheet section 5.4.3
+  // humidity oversampling x 1 or skipped: 0x01 or 0x00
+  _ctrlHum = (_channels & CHANNEL_HUMIDITY) ? 0b00000001 : 0b00000000;
+
+  // apply right away if the sensor has already been started
+  if ((_chipID == CHIP_ID_BMP280) || (_chipID == CHIP_ID_BME280)) {
+    return applyOversamplingControls();
+  }
+
   return ERROR_OK;
 }
 
+/// \brief
+/// getChannels
+/// \details
+/// Channels currently enabled for conversion
+uint8_t ForcedBMX280::getChannels() {
+  return _channels;
+}
+
+/// \brief
+/// Oversampling
+/// \details
+/// Maps an oversampling setting (osrs_x) to the number of samples:
+/// 0, 1, 2, 3, 4, 5 and above map to 0, 1, 2, 4, 8, 16
+uint8_t ForcedBMX280::oversampling(uint8_t osrs) {
+  osrs &= 0x07;
+  if (osrs > 5) osrs = 5;
+  return (1 << osrs) >> 1;
+}
+
+/// \brief
+/// Get samples
+/// \details
+/// Decodes the number of samples per channel from the control registers
+ForcedBMX280::samples ForcedBMX280::getSamples() {
+  samples osrs;
+  osrs.temperature = oversampling(_ctrlMeas >> 5);
+  osrs.pressure = oversampling(_ctrlMeas >> 2);
+  osrs.humidity = oversampling(_ctrlHum);
+
+  return osrs;
+}
+
+/// \brief
+/// getAvailableChannels
+/// \details
+/// Channels supported by the class and - after begin() - by the connected chip
+uint8_t ForcedBMX280::getAvailableChannels() {
+  return _availableChannels;
+}
+
+/// \brief
+/// getMeasurementTime
+/// \details
+/// Maximum conversion time of a forced measurement in microseconds
+/// for the enabled channels - see datasheet section 9.1
+uint32_t ForcedBMX280::getMeasurementTime() {
+  samples osrs = getSamples();
+
+  uint32_t time = 1250 + 2300 * (uint32_t)osrs.temperature;
+  if (osrs.pressure) time += 2300 * (uint32_t)osrs.pressure + 575;
+  if (osrs.humidity) time += 2300 * (uint32_t)osrs.humidity + 575;
+
+  return time;
+}
+
+/// \brief
+/// getTypicalMeasurementTime
+/// \details
+/// Typical conversion time of a forced measurement in microseconds
+/// for the given samples per channel - see datasheet section 9.1
+uint32_t ForcedBMX280::getTypicalMeasurementTime(const samples& osrs) {
+  uint32_t time = 1000 + 2000 * (uint32_t)osrs.temperature;
+  if (osrs.pressure) time += 2000 * (uint32_t)osrs.pressure + 500;
+  if (osrs.humidity) time += 2000 * (uint32_t)osrs.humidity + 500;
+
+  return time;
+}
+
+/// \brief
+/// getChargePerSample
+/// \details
+/// Estimated charge drawn by the sensor for a forced measurement of
+/// the enabled channels in nC. Computed from the typical conversion
+/// times (datasheet section 9.1) and the typical currents during
+/// measurement (datasheet table 1). The start-up phase is accounted
+/// for with the current of the temperature measurement.
+uint32_t ForcedBMX280::getChargePerSample() {
+  return getChargePerSample(getSamples());
+}
+
+/// \brief
+/// getChargePerSample
+/// \details
+/// Estimated charge in nC for the given samples per channel, see above.
+uint32_t ForcedBMX280::getChargePerSample(const samples& osrs) {
+  // uA * ms = nC
+  uint32_t charge = (1000 + 2000 * (uint32_t)osrs.temperature) * CURRENT_TEMPERATURE / 1000;
+  if (osrs.pressure) charge += (2000 * (uint32_t)osrs.pressure + 500) * CURRENT_PRESSURE / 1000;
+  if (osrs.humidity) charge += (2000 * (uint32_t)osrs.humidity + 500) * CURRENT_HUMIDITY / 1000;
+
+  return charge;
+}
+
+/// \brief
+/// getAverageCurrent
+/// \details
+/// Estimated average current in nA when taking a forced measurement every
+/// samplingInterval milliseconds. The sensor sleeps in between measurements.
+/// Sampling intervals shorter than the measurement time are treated as
+/// continuous measurements.
+uint32_t ForcedBMX280::getAverageCurrent(const uint32_t samplingInterval) {
+  samples osrs = getSamples();
+  uint32_t measurementTime = getTypicalMeasurementTime(osrs);
+  uint32_t interval = (measurementTime + 999) / 1000;
+  if (samplingInterval > interval) interval = samplingInterval;
+
+  // nC / ms = uA, plus sleep current for the remainder of the interval
+  uint32_t current = getChargePerSample(osrs) * 1000 / interval;
+  current += CURRENT_SLEEP - CURRENT_SLEEP * measurementTime / 1000 / interval;
+
+  return current;
+}
+
+/// \brief
+/// getBusTime
+/// \details
+/// Time in microseconds spent on the bus for the last sample, i.e. for
+/// starting the forced measurement and reading the results since then.
+#ifdef FORCED_BMX280_BUS_TIME
+uint32_t ForcedBMX280::getBusTime() {
+  return _busTime;
+}
+#endif
+
+/// \brief
+/// Take forced measurement
+/// \details
+/// This function takes a forced measurement. That is, the BME280 is woken up to take
+/// a measurement after which it goes back to sleep. During this sleep, it consumes
+/// 0.25uA! Only the enabled channels are converted, see setChannels().
+/// Returns an error code if there was one from the bus
+uint8_t ForcedBMX280::takeForcedMeasurement() {
+#ifdef FORCED_BMX280_BUS_TIME
+  uint32_t start = micros();
+  uint8_t error = write8((uint8_t)registers::CTRL_MEAS, _ctrlMeas);
+  _busTime = micros() - start;
+
+  return error;
+#else
+  return write8((uint8_t)registers::CTRL_MEAS, _ctrlMeas);
+#endif
+}
+
 /// \brief
 /// Apply oversampling controls
 /// \details
-/// This function sets the sampling controls to values that are
-/// suitable for all kinds of applications.
+/// This function writes the sampling controls for the enabled channels
+/// as prepared by setChannels().
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBMX280::applyOversamplingControls() {
 
   // Set in sleep mode to provide write access to the “config” register
   if (write8((uint8_t)registers::CTRL_MEAS, 0)) return ERROR_BUS;
 
-  // ctrl_meas - see datasheet section 5.4.5
-  // forced mode: ctrl_meas[0..1] 0b01 (0b11 for normal and 0b00 for sleep mode)
-  // pressure oversampling x 1: ctrl_meas[4..2] 0b001
-  // temperature oversampling x 1: ctrl_meas[7..5] 0b001
-  if (write8((uint8_t)registers::CTRL_MEAS, 0b00100101)) return ERROR_BUS;
+  // ctrl_meas as prepared by setChannels()
+  if (write8((uint8_t)registers::CTRL_MEAS, _ctrlMeas)) return ERROR_BUS;
   return ERROR_OK;
 }
 
@@ -189,7 +532,7 @@ uint8_t ForcedBMX280::applyOversamplingControls() {
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBMX280::readCalibrationData() {
   if (setReg((uint8_t)registers::TEMP_CALIB)) return ERROR_BUS;
-  _bus.requestFrom(_address, (uint8_t)6);
+  requestFrom((uint8_t)6);
   // read 6 bytes for temperature calibration data
   for (int i = 1; i <= 3; i++) _temperature[i] = readTwoRegisters();  // Temperature
 
@@ -205,17 +548,21 @@ uint8_t ForcedBMX280::readCalibrationData() {
 /// \brief
 /// Get Temperature Celsius
 /// \details
-/// This function retrieves the compensated temperature
+/// This function retrieves the compensated temperature.
+/// Returns 0 if there was an error from the bus, leaving the fine
+/// temperature of the last reading untouched.
 int32_t ForcedBMX280::getTemperatureCelsius(const bool performMeasurement) {
-  _bus.beginTransmission(_address);
-  if (performMeasurement) {
-    _bus.write((uint8_t)registers::CTRL_MEAS);
-    _bus.write(0b00100101);
-  }
-  _bus.write((uint8_t)registers::TEMP_MSB);
-  _bus.endTransmission();
-  _bus.requestFrom(_address, (uint8_t)3);
-  int32_t adc = readFourRegisters();
+  uint8_t data[3];
+  if (readBurst((uint8_t)registers::TEMP_MSB, data, 3, performMeasurement)) return 0;
+  return compensateTemperature(parseRawValue(data));
+}
+
+/// \brief
+/// Compensate temperature
+/// \details
+/// This function compensates a raw temperature reading (adc) and
+/// updates the fine temperature used by the other channels.
+int32_t ForcedBMX280::compensateTemperature(int32_t adc) {
   int32_t var1 = ((((adc >> 3) - ((int32_t)((uint16_t)_temperature[1]) << 1))) * ((int32_t)_temperature[2])) >> 11;
   int32_t var2 = ((((adc >> 4) - ((int32_t)((uint16_t)_temperature[1]))) * ((adc >> 4) - ((int32_t)((uint16_t)_temperature[1])))) >> 12);
   var2 = (var2 * ((int32_t)_temperature[3])) >> 14;
@@ -243,8 +590,7 @@ ForcedBMX280Float::ForcedBMX280Float(USI_TWI& bus, const uint8_t address)
 ForcedBMX280Float::ForcedBMX280Float(TwoWire& bus, const uint8_t address)
   :
 #endif
-    _bus(bus),
-    _address(address) {
+    ForcedBMX280(bus, address) {
   /*..*/
 }
 
@@ -275,9 +621,9 @@ ForcedBMP280::ForcedBMP280(USI_TWI& bus, const uint8_t address)
 ForcedBMP280::ForcedBMP280(TwoWire& bus, const uint8_t address)
   :
 #endif
-    _bus(bus),
-    _address(address) {
-  /*..*/
+    ForcedBMX280(bus, address) {
+  _availableChannels |= CHANNEL_PRESSURE;
+  setChannels(_availableChannels);
 }
 
 /// \brief
@@ -289,7 +635,7 @@ ForcedBMP280::ForcedBMP280(TwoWire& bus, const uint8_t address)
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBMP280::readCalibrationData() {
   if (setReg((uint8_t)registers::TEMP_CALIB)) return ERROR_BUS;
-  _bus.requestFrom(_address, (uint8_t)24);
+  requestFrom((uint8_t)24);
   // read 24 bytes for temperature and pressure calibration data
   for (int i = 1; i <= 3; i++) _temperature[i] = readTwoRegisters();  // Temperature
   for (int i = 1; i <= 9; i++) _pressure[i] = readTwoRegisters();     // Pressure
@@ -306,18 +652,23 @@ uint8_t ForcedBMP280::readCalibrationData() {
 /// \brief
 /// Get Pressure
 /// \details
-/// This function retrieves the compensated pressure
+/// This function retrieves the compensated pressure.
+/// Returns 0 if there was an error from the bus
 uint32_t ForcedBMP280::getPressure(const bool performMeasurement) {
-  _bus.beginTransmission(_address);
-  if (performMeasurement) {
-    _bus.write((uint8_t)registers::CTRL_MEAS);
-    _bus.write(0b00100101);
-  }
-  _bus.write((uint8_t)registers::PRESS_MSB);
-  _bus.endTransmission();
-  _bus.requestFrom(_address, (uint8_t)3);
+  // silently bail out if the pressure channel is skipped
+  if (!(_channels & CHANNEL_PRESSURE)) return 0;
 
-  int32_t adc = readFourRegisters();
+  uint8_t data[3];
+  if (readBurst((uint8_t)registers::PRESS_MSB, data, 3, performMeasurement)) return 0;
+  return compensatePressure(parseRawValue(data));
+}
+
+/// \brief
+/// Compensate pressure
+/// \details
+/// This function compensates a raw pressure reading (adc)
+/// using the fine temperature of the last temperature reading.
+uint32_t ForcedBMP280::compensatePressure(int32_t adc) {
   int32_t var1 = (((int32_t)_BMX280t_fine) >> 1) - (int32_t)64000;
   int32_t var2 = (((var1 >> 2) * (var1 >> 2)) >> 11) * ((int32_t)_pressure[6]);
   var2 = var2 + ((var1 * ((int32_t)_pressure[5])) << 1);
@@ -360,8 +711,7 @@ ForcedBMP280Float::ForcedBMP280Float(USI_TWI& bus, const uint8_t address)
 ForcedBMP280Float::ForcedBMP280Float(TwoWire& bus, const uint8_t address)
 :
 #endif
-    _bus(bus),
-    _address(address) {
+    ForcedBMP280(bus, address) {
   /*..*/
 }
 
@@ -399,16 +749,16 @@ ForcedBME280::ForcedBME280(USI_TWI& bus, const uint8_t address)
 ForcedBME280::ForcedBME280(TwoWire& bus, const uint8_t address)
 :
 #endif
-    _bus(bus),
-    _address(address) {
-  /*..*/
+    ForcedBMP280(bus, address) {
+  _availableChannels |= CHANNEL_HUMIDITY;
+  setChannels(_availableChannels);
 }
 
 /// \brief
 /// Apply oversampling controls
 /// \details
-/// This function sets the sampling controls to values that are
-/// suitable for all kinds of applications.
+/// This function writes the sampling controls for the enabled channels
+/// as prepared by setChannels().
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBME280::applyOversamplingControls() {
 
@@ -416,17 +766,18 @@ uint8_t ForcedBME280::applyOversamplingControls() {
   if (write8((uint8_t)registers::CTRL_MEAS, 0)) return ERROR_BUS;
 
   // humidity oversampling - see datasheet section 5.4.3
-  // oversampling x 1: 0x01
-  // only to be set when a BME280 is used
+  // only to be set when a BME280 is used, a BMP280 has no humidity channel
   if (_chipID == CHIP_ID_BME280) {
-    if (write8((uint8_t)registers::CTRL_HUM, 0b00000001)) return ERROR_BUS;
+    if (write8((uint8_t)registers::CTRL_HUM, _ctrlHum)) return ERROR_BUS;
+  } else {
+    _availableChannels &= ~CHANNEL_HUMIDITY;
+    _channels &= ~CHANNEL_HUMIDITY;
+    _ctrlHum = 0;
   }
 
-  // ctrl_meas - see datasheet section 5.4.5
-  // forced mode: ctrl_meas[0..1] 0b01 (0b11 for normal and 0b00 for sleep mode)
-  // pressure oversampling x 1: ctrl_meas[4..2] 0b001
-  // temperature oversampling x 1: ctrl_meas[7..5] 0b001
-  if (write8((uint8_t)registers::CTRL_MEAS, 0b00100101)) return ERROR_BUS;
+  // ctrl_meas as prepared by setChannels()
+  // changes to ctrl_hum only become effective after writing ctrl_meas
+  if (write8((uint8_t)registers::CTRL_MEAS, _ctrlMeas)) return ERROR_BUS;
   return ERROR_OK;
 }
 
@@ -439,7 +790,7 @@ uint8_t ForcedBME280::applyOversamplingControls() {
 /// Returns an error code if there was one from the bus
 uint8_t ForcedBME280::readCalibrationData() {
   if (setReg((uint8_t)registers::TEMP_CALIB)) return ERROR_BUS;
-  _bus.requestFrom(_address, (uint8_t)24);
+  requestFrom((uint8_t)24);
   // read 24 bytes for temperature and pressure calibration data
   for (int i = 1; i <= 3; i++) _temperature[i] = readTwoRegisters();  // Temperature
   for (int i = 1; i <= 9; i++) _pressure[i] = readTwoRegisters();     // Pressure
@@ -451,14 +802,14 @@ uint8_t ForcedBME280::readCalibrationData() {
 
     // read second part of humidity calibration data
     if (setReg((uint8_t)registers::SCND_HUM_CALIB)) return ERROR_BUS;
-    _bus.requestFrom(_address, (uint8_t)7);
+    requestFrom((uint8_t)7);
     _humidity[2] = readTwoRegisters();
-    _humidity[3] = (uint8_t)_bus.read();
-    uint8_t e4 = _bus.read();
-    uint8_t e5 = _bus.read();
+    _humidity[3] = (uint8_t)readByte();
+    uint8_t e4 = readByte();
+    uint8_t e5 = readByte();
     _humidity[4] = ((int16_t)((e4 << 4) + (e5 & 0x0F)));
-    _humidity[5] = ((int16_t)((_bus.read() << 4) + ((e5 >> 4) & 0x0F)));
-    _humidity[6] = ((int8_t)_bus.read());
+    _humidity[5] = ((int16_t)((readByte() << 4) + ((e5 >> 4) & 0x0F)));
+    _humidity[6] = ((int8_t)readByte());
   }
 
   // get temperature reading to initialize BMX280t_fine
@@ -473,22 +824,23 @@ uint8_t ForcedBME280::readCalibrationData() {
 /// \brief
 /// Get Humidity
 /// \details
-/// This function retrieves the compensated humidity 
+/// This function retrieves the compensated humidity.
+/// Returns 0 if there was an error from the bus
 uint32_t ForcedBME280::getRelativeHumidity(const bool performMeasurement) {
-  // silently bail out if it is the wrong type of sensor
-  if (_chipID != CHIP_ID_BME280) return 0;
+  // silently bail out if it is the wrong type of sensor or the humidity channel is skipped
+  if (!(_channels & CHANNEL_HUMIDITY)) return 0;
 
-  _bus.beginTransmission(_address);
-  if (performMeasurement) {
-    _bus.write((uint8_t)registers::CTRL_MEAS);
-    _bus.write(0b00100101);
-  }
-  _bus.write((uint8_t)registers::HUM_MSB);
-  _bus.endTransmission();
-  _bus.requestFrom(_address, (uint8_t)2);
-  uint8_t hi = _bus.read();
-  uint8_t lo = _bus.read();
-  int32_t adc = (uint16_t)(hi << 8 | lo);
+  uint8_t data[2];
+  if (readBurst((uint8_t)registers::HUM_MSB, data, 2, performMeasurement)) return 0;
+  return compensateHumidity((uint16_t)(data[0] << 8 | data[1]));
+}
+
+/// \brief
+/// Compensate humidity
+/// \details
+/// This function compensates a raw humidity reading (adc)
+/// using the fine temperature of the last temperature reading.
+uint32_t ForcedBME280::compensateHumidity(int32_t adc) {
   int32_t var1;
   var1 = (_BMX280t_fine - ((int32_t)76800));
   var1 = (((((adc << 14) - (((int32_t)_humidity[4]) << 20) - (((int32_t)_humidity[5]) * var1)) + ((int32_t)16384)) >> 15) * (((((((var1 * ((int32_t)_humidity[6])) >> 10) * (((var1 * ((int32_t)_humidity[3])) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) * ((int32_t)_humidity[2]) + 8192) >> 14));
@@ -516,8 +868,7 @@ ForcedBME280Float::ForcedBME280Float(USI_TWI& bus, const uint8_t address)
 ForcedBME280Float::ForcedBME280Float(TwoWire& bus, const uint8_t address)
 :
 #endif
-    _bus(bus),
-    _address(address) {
+    ForcedBME280(bus, address) {
   /*..*/
 }
 
@@ -545,3 +896,170 @@ float ForcedBME280Float::getPressureAsFloat(const bool performMeasurement) {
 float ForcedBME280Float::getRelativeHumidityAsFloat(const bool performMeasurement) {
   return float(getRelativeHumidity(performMeasurement) / 100.0);
 }
+
+/* ForcedBMX280Auto
+   Version of the sensor adapting to the connected chip (BMP280 or BME280).
+
+   Supports all of the above plus reading all enabled channels at once.
+   The path for reading is selected once with begin() and setChannels(),
+   so readings don't need to check the chip ID or the enabled channels.
+*/
+/// \brief
+/// Constructor
+/// \details
+/// This creates an object from the mandatory TwoWire-bus
+/// and the address of the chip to communicate with.
+#ifdef FORCED_BMX280_ATTINY
+ForcedBMX280Auto::ForcedBMX280Auto(USI_TWI& bus, const uint8_t address)
+:
+#else
+ForcedBMX280Auto::ForcedBMX280Auto(TwoWire& bus, const uint8_t address)
+:
+#endif
+    ForcedBME280Float(bus, address),
+    _readPath(&ForcedBMX280Auto::readUnavailable),
+    _started(false) {
+  /*..*/
+}
+
+/// \brief
+/// begin
+/// \details
+/// This starts the sensor like ForcedBME280::begin() does. The path for
+/// getReading() is only selected once the sensor has been started
+/// successfully, including the calibration data.
+/// Returns an error code if there was one from the bus the chipID is not matching BME280 or BMP280
+uint8_t ForcedBMX280Auto::begin() {
+  _started = false;
+  _readPath = &ForcedBMX280Auto::readUnavailable;
+
+  uint8_t error = ForcedBME280Float::begin();
+  if (error) return error;
+
+  _started = true;
+  selectReadPath();
+
+  return ERROR_OK;
+}
+
+/// \brief
+/// Apply oversampling controls
+/// \details
+/// This function writes the sampling controls for the enabled channels
+/// and - if the sensor has been started - selects the matching path for getReading().
+/// Returns an error code if there was one from the bus
+uint8_t ForcedBMX280Auto::applyOversamplingControls() {
+  if (ForcedBME280::applyOversamplingControls()) {
+    _readPath = &ForcedBMX280Auto::readUnavailable;
+    return ERROR_BUS;
+  }
+
+  if (_started) selectReadPath();
+  return ERROR_OK;
+}
+
+/// \brief
+/// Select read path
+/// \details
+/// This function selects the path for getReading() matching the enabled channels.
+void ForcedBMX280Auto::selectReadPath() {
+  // indexed by the enabled channels besides temperature
+  static const readPath paths[] = {
+    &ForcedBMX280Auto::readTemperature,
+    &ForcedBMX280Auto::readTemperaturePressure,
+    &ForcedBMX280Auto::readTemperatureHumidity,
+    &ForcedBMX280Auto::readAll
+  };
+
+  _readPath = paths[(_channels >> 1) & 0x03];
+}
+
+/// \brief
+/// Get reading
+/// \details
+/// This function retrieves the compensated values of all enabled channels
+/// with a single burst read. Values of skipped channels are set to 0.
+/// Returns an error code if there was one from the bus or
+/// ERROR_SENSOR_TYPE if the sensor wasn't started with begin()
+uint8_t ForcedBMX280Auto::getReading(BMX280Reading& reading, const bool performMeasurement) {
+  return (this->*_readPath)(reading, performMeasurement);
+}
+
+/// \brief
+/// Read unavailable
+/// \details
+/// Path used as long as the sensor wasn't started with begin()
+/// or the sampling controls couldn't be applied.
+uint8_t ForcedBMX280Auto::readUnavailable(BMX280Reading& reading, const bool performMeasurement) {
+  (void)performMeasurement;
+  reading.channels = 0;
+  reading.temperature = 0;
+  reading.pressure = 0;
+  reading.humidity = 0;
+
+  return ERROR_SENSOR_TYPE;
+}
+
+/// \brief
+/// Read temperature
+/// \details
+/// Path for temperature only: temp_msb..temp_xlsb (0xFA..0xFC)
+uint8_t ForcedBMX280Auto::readTemperature(BMX280Reading& reading, const bool performMeasurement) {
+  uint8_t data[3];
+  if (readBurst((uint8_t)registers::TEMP_MSB, data, 3, performMeasurement)) return ERROR_BUS;
+
+  reading.channels = CHANNEL_TEMPERATURE;
+  reading.temperature = compensateTemperature(parseRawValue(data));
+  reading.pressure = 0;
+  reading.humidity = 0;
+
+  return ERROR_OK;
+}
+
+/// \brief
+/// Read temperature and pressure
+/// \details
+/// Path for temperature and pressure: press_msb..temp_xlsb (0xF7..0xFC)
+uint8_t ForcedBMX280Auto::readTemperaturePressure(BMX280Reading& reading, const bool performMeasurement) {
+  uint8_t data[6];
+  if (readBurst((uint8_t)registers::PRESS_MSB, data, 6, performMeasurement)) return ERROR_BUS;
+
+  reading.channels = CHANNEL_TEMPERATURE | CHANNEL_PRESSURE;
+  reading.temperature = compensateTemperature(parseRawValue(&data[3]));
+  reading.pressure = compensatePressure(parseRawValue(&data[0]));
+  reading.humidity = 0;
+
+  return ERROR_OK;
+}
+
+/// \brief
+/// Read temperature and humidity
+/// \details
+/// Path for temperature and humidity: temp_msb..hum_lsb (0xFA..0xFE)
+uint8_t ForcedBMX280Auto::readTemperatureHumidity(BMX280Reading& reading, const bool performMeasurement) {
+  uint8_t data[5];
+  if (readBurst((uint8_t)registers::TEMP_MSB, data, 5, performMeasurement)) return ERROR_BUS;
+
+  reading.channels = CHANNEL_TEMPERATURE | CHANNEL_HUMIDITY;
+  reading.temperature = compensateTemperature(parseRawValue(&data[0]));
+  reading.pressure = 0;
+  reading.humidity = compensateHumidity((uint16_t)(data[3] << 8 | data[4]));
+
+  return ERROR_OK;
+}
+
+/// \brief
+/// Read all
+/// \details
+/// Path for temperature, pressure and humidity: press_msb..hum_lsb (0xF7..0xFE)
+uint8_t ForcedBMX280Auto::readAll(BMX280Reading& reading, const bool performMeasurement) {
+  uint8_t data[8];
+  if (readBurst((uint8_t)registers::PRESS_MSB, data, 8, performMeasurement)) return ERROR_BUS;
+
+  reading.channels = CHANNEL_TEMPERATURE | CHANNEL_PRESSURE | CHANNEL_HUMIDITY;
+  reading.temperature = compensateTemperature(parseRawValue(&data[3]));
+  reading.pressure = compensatePressure(parseRawValue(&data[0]));
+  reading.humidity = compensateHumidity((uint16_t)(data[6] << 8 | data[7]));
+
+  return ERROR_OK;
+}
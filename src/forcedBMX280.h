@@ -13,6 +13,14 @@
 #define FORCED_BMX280_ATTINY
 #endif
 
+// measure the time spent on the bus, see getBusTime()
+// uncomment here (not in your sketch) or define it via build flags
+// #define FORCED_BMX280_BUS_TIME
+
+// record the bus transactions into a buffer, see setTraceBuffer()
+// uncomment here (not in your sketch) or define it via build flags
+// #define FORCED_BMX280_TRACE
+
 #include <Arduino.h>
 
 #ifdef FORCED_BMX280_ATTINY
@@ -30,7 +38,25 @@
 #define STATUS_IM_UPDATE (0)        // im_update bit in status register
 #define BMX280_I2C_ADDR (0x76)      // standard I2C-Address of sensor
 #define BMX280_I2C_ALT_ADDR (0x77)  // alternative I2C-Address of sensor
-
+#define CHANNEL_TEMPERATURE (0x01)  // temperature channel (always converted)
+#define CHANNEL_PRESSURE (0x02)     // pressure channel
+#define CHANNEL_HUMIDITY (0x04)     // humidity channel (BME280 only)
+#define CURRENT_TEMPERATURE (350)   // typ. current during temperature measurement in uA
+#define CURRENT_PRESSURE (714)      // typ. current during pressure measurement in uA
+#define CURRENT_HUMIDITY (340)      // typ. current during humidity measurement in uA
+#define CURRENT_SLEEP (100)         // typ. current in sleep mode in nA
+#define TRACE_READ (0x80)           // trace record header: bytes read from the sensor
+#define TRACE_ERROR (0x40)          // trace record header: bus error, status byte follows
+#define TRACE_LENGTH (0x3F)         // trace record header: number of payload bytes
+
+
+// reading of all enabled channels as returned by ForcedBMX280Auto
+struct BMX280Reading {
+  uint8_t channels;     // channels contained in the reading
+  int32_t temperature;  // temperature - value of 1234 would be 12.34 °C
+  uint32_t pressure;    // pressure in Pa - value of 101325 would be 1013.25 hPa
+  uint32_t humidity;    // humidity - value of 4321 would be 43.21 %rh
+};
 
 class ForcedBMX280 {
 protected:
@@ -48,11 +74,55 @@ protected:
   // fine temperature as global variable
   int32_t _BMX280t_fine;
 
+  // enabled and available channels
+  uint8_t _channels;
+  uint8_t _availableChannels;
+
+  // control register values for the enabled channels
+  uint8_t _ctrlMeas;
+  uint8_t _ctrlHum;
+
+#ifdef FORCED_BMX280_BUS_TIME
+  // time spent on the bus for the last sample
+  uint32_t _busTime;
+#endif
+
+  // number of samples per channel as set in the control registers
+  struct samples {
+    uint8_t temperature;
+    uint8_t pressure;
+    uint8_t humidity;
+  };
+
+#ifdef FORCED_BMX280_TRACE
+  // optional bus trace
+  uint8_t* _trace;
+  uint16_t _traceSize;
+  uint16_t _traceLength;
+  uint16_t _traceRecord;
+  uint16_t _traceTransaction;
+
+  void beginTraceRecord(uint8_t header);
+  void appendTraceRecord(uint8_t value);
+#endif
+
+  void beginTransmission();
+  void writeByte(uint8_t value);
+  uint8_t endTransmission();
+  uint8_t requestFrom(uint8_t count);
+  uint8_t readByte();
+
   int16_t readTwoRegisters();
-  int32_t readFourRegisters();
+  int32_t parseRawValue(const uint8_t* data);
+  uint8_t readBurst(uint8_t reg, uint8_t* data, uint8_t length, const bool performMeasurement);
+  int32_t compensateTemperature(int32_t adc);
   uint8_t read8(uint8_t reg);
   uint8_t write8(uint8_t reg, uint8_t value);
   uint8_t setReg(uint8_t reg);
+  samples getSamples();
+  static uint8_t oversampling(uint8_t osrs);
+  static uint32_t getTypicalMeasurementTime(const samples& osrs);
+  static uint32_t getChargePerSample(const samples& osrs);
 
   virtual uint8_t applyOversamplingControls();
   virtual uint8_t readCalibrationData();
@@ -78,22 +148,27 @@ public:
   ForcedBMX280(TwoWire& bus = Wire, const uint8_t address = BMX280_I2C_ADDR);
 #endif
 
-  uint8_t begin();
+  virtual uint8_t begin();
   uint8_t takeForcedMeasurement();
   uint8_t getChipID();
+  uint8_t setChannels(const uint8_t channels);
+  uint8_t getChannels();
+  uint8_t getAvailableChannels();
+  uint32_t getMeasurementTime();
+  uint32_t getChargePerSample();
+  uint32_t getAverageCurrent(const uint32_t samplingInterval);
+#ifdef FORCED_BMX280_BUS_TIME
+  uint32_t getBusTime();
+#endif
+#ifdef FORCED_BMX280_TRACE
+  void setTraceBuffer(uint8_t* buffer, const uint16_t size);
+  uint16_t getTraceLength();
+#endif
 
   int32_t getTemperatureCelsius(const bool performMeasurement = false);
 };
 
 class ForcedBMX280Float : public ForcedBMX280 {
-protected:
-#ifdef FORCED_BMX280_ATTINY
-  USI_TWI& _bus;
-#else
-  TwoWire& _bus;
-#endif
-  uint8_t _address;
-
 public:
 #ifdef FORCED_BMX280_ATTINY
   ForcedBMX280Float(USI_TWI& buss = TinyWireM, const uint8_t address = BMX280_I2C_ADDR);
@@ -106,17 +181,11 @@ public:
 
 class ForcedBMP280 : public ForcedBMX280 {
 protected:
-#ifdef FORCED_BMX280_ATTINY
-  USI_TWI& _bus;
-#else
-  TwoWire& _bus;
-#endif
-  uint8_t _address;
-
   // additional calibration data
   int16_t _pressure[10];
 
   virtual uint8_t readCalibrationData();
+  uint32_t compensatePressure(int32_t adc);
 
 public:
 #ifdef FORCED_BMX280_ATTINY
@@ -129,14 +198,6 @@ public:
 };
 
 class ForcedBMP280Float : public ForcedBMP280 {
-protected:
-#ifdef FORCED_BMX280_ATTINY
-  USI_TWI& _bus;
-#else
-  TwoWire& _bus;
-#endif
-  uint8_t _address;
-
 public:
 #ifdef FORCED_BMX280_ATTINY
   ForcedBMP280Float(USI_TWI& bus = TinyWireM, const uint8_t address = BMX280_I2C_ADDR);
@@ -151,18 +212,12 @@ public:
 
 class ForcedBME280 : public ForcedBMP280 {
 protected:
-#ifdef FORCED_BMX280_ATTINY
-  USI_TWI& _bus;
-#else
-  TwoWire& _bus;
-#endif
-  uint8_t _address;
-
   // additional calibration data
   int16_t _humidity[7];
 
   virtual uint8_t applyOversamplingControls();
   virtual uint8_t readCalibrationData();
+  uint32_t compensateHumidity(int32_t adc);
 
 public:
 #ifdef FORCED_BMX280_ATTINY
@@ -175,14 +230,6 @@ public:
 };
 
 class ForcedBME280Float : public ForcedBME280 {
-protected:
-#ifdef FORCED_BMX280_ATTINY
-  USI_TWI& _bus;
-#else
-  TwoWire& _bus;
-#endif
-  uint8_t _address;
-
 public:
 #ifdef FORCED_BMX280_ATTINY
   ForcedBME280Float(USI_TWI& bus = TinyWireM, const uint8_t address = BMX280_I2C_ADDR);
@@ -195,5 +242,33 @@ public:
   float getRelativeHumidityAsFloat(const bool performMeasurement = false);
 };
 
+class ForcedBMX280Auto : public ForcedBME280Float {
+protected:
+  typedef uint8_t (ForcedBMX280Auto::*readPath)(BMX280Reading& reading, const bool performMeasurement);
+
+  // path for reading the enabled channels, selected with begin() and setChannels()
+  readPath _readPath;
+  bool _started;
+
+  virtual uint8_t applyOversamplingControls();
+  void selectReadPath();
+
+  uint8_t readUnavailable(BMX280Reading& reading, const bool performMeasurement);
+  uint8_t readTemperature(BMX280Reading& reading, const bool performMeasurement);
+  uint8_t readTemperaturePressure(BMX280Reading& reading, const bool performMeasurement);
+  uint8_t readTemperatureHumidity(BMX280Reading& reading, const bool performMeasurement);
+  uint8_t readAll(BMX280Reading& reading, const bool performMeasurement);
+
+public:
+#ifdef FORCED_BMX280_ATTINY
+  ForcedBMX280Auto(USI_TWI& bus = TinyWireM, const uint8_t address = BMX280_I2C_ADDR);
+#else
+  ForcedBMX280Auto(TwoWire& bus = Wire, const uint8_t address = BMX280_I2C_ADDR);
+#endif
+
+  virtual uint8_t begin();
+  uint8_t getReading(BMX280Reading& reading, const bool performMeasurement = false);
+};
+
 
 #endif  //__FORCED_BMX280_HPP